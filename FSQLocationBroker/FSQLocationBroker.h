@@ -11,7 +11,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 @protocol FSQLocationSubscriber, FSQRegionMonitoringSubscriber;
 
-@protocol FSQVisitMonitoringSubscriber;
+@protocol FSQVisitMonitoringSubscriber, FSQSubscriberChangeNotifying;
 
 #pragma mark - FSQLocationBroker interface
 /**
@@ -129,7 +129,7 @@ NS_ASSUME_NONNULL_BEGIN
  location subscribers.
  
  This method is called automatically for you when a subscriber is added or removed, or when the relevant properties
- on the subscribers change if they are KVO-compliant.
+ on the subscribers change if they are KVO-compliant or report their changes via `locationSubscriberDidChange:`.
  */
 - (void)refreshLocationSubscribers NS_REQUIRES_SUPER;
 
@@ -165,7 +165,7 @@ NS_ASSUME_NONNULL_BEGIN
  region monitoring subscribers.
  
  This method is called automatically for you when a subscriber is added, or when the relevant properties
- on the subscribers change if they are KVO-compliant.
+ on the subscribers change if they are KVO-compliant or report their changes via `regionMonitoringSubscriberDidChange:`.
  
  @note This will not remove regions being monitored if their subscriber ids do not match any known subscribers, as
  those subscribers might be added later and repaired with their regions (eg after an app relaunch).
@@ -243,6 +243,55 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)removeAllSubscribers NS_REQUIRES_SUPER;
 
+/**
+ Tells the broker that the @c desiredAccuracy or @c locationSubscriberOptions of a location subscriber changed.
+ 
+ Only subscribers conforming to FSQSubscriberChangeNotifying need to call this. Calls are counted in the subscriber's
+ change generation and coalesced, so several changes made in a row result in a single refresh on the main thread.
+ 
+ @param locationSubscriber The subscriber that changed. If this object is not currently in the broker's location
+ subscriber list, or does not conform to FSQSubscriberChangeNotifying, this method does nothing.
+ */
+- (void)locationSubscriberDidChange:(NSObject<FSQLocationSubscriber> *)locationSubscriber NS_REQUIRES_SUPER;
+
+/**
+ Tells the broker that the @c monitoredRegions of a region monitoring subscriber changed.
+ 
+ Only subscribers conforming to FSQSubscriberChangeNotifying need to call this. Calls are counted in the subscriber's
+ change generation and coalesced, so several changes made in a row result in a single refresh on the main thread.
+ 
+ @param regionSubscriber The subscriber that changed. If this object is not currently in the broker's region
+ monitoring subscriber list, or does not conform to FSQSubscriberChangeNotifying, this method does nothing.
+ */
+- (void)regionMonitoringSubscriberDidChange:(NSObject<FSQRegionMonitoringSubscriber> *)regionSubscriber NS_REQUIRES_SUPER;
+
+/**
+ Tells the broker that the @c shouldMonitorVisits value of a visit subscriber changed.
+ 
+ Only subscribers conforming to FSQSubscriberChangeNotifying need to call this. Calls are counted in the subscriber's
+ change generation and coalesced, so several changes made in a row result in a single refresh on the main thread.
+ 
+ @param visitSubscriber The subscriber that changed. If this object is not currently in the broker's visit
+ subscriber list, or does not conform to FSQSubscriberChangeNotifying, this method does nothing.
+ */
+- (void)visitSubscriberDidChange:(NSObject<FSQVisitMonitoringSubscriber> *)visitSubscriber NS_REQUIRES_SUPER;
+
+/**
+ The number of change notifications the broker has received from a subscriber during its current registration.
+ 
+ This is useful for finding subscribers that change their settings at a high frequency.
+ 
+ @param subscriber A subscriber conforming to FSQSubscriberChangeNotifying.
+ 
+ @return The subscriber's current change generation, or 0 if the subscriber is not registered with the broker or
+ does not conform to FSQSubscriberChangeNotifying. If the same object is registered as more than one subscriber type,
+ the sum across all of them is returned.
+ 
+ @note The count restarts at 0 every time the subscriber is added. Because additions are processed on a background
+ queue, changes reported before the addition has been processed are not counted.
+ */
+- (NSUInteger)changeGenerationForSubscriber:(NSObject<FSQSubscriberChangeNotifying> *)subscriber;
+
 /**
  Request InUse Authorization.
  
@@ -336,6 +385,9 @@ typedef NS_OPTIONS(NSUInteger, FSQLocationSubscriberOptions) {
  There is no guarantee changing the return values will affect _FSQLocationBroker_ behavior if
  you do not refresh the subscribers list. The broker will automatically try to observe and refresh after
  values change for KVO compliant properties.
+ 
+ Subscribers conforming to FSQSubscriberChangeNotifying are not observed and must instead report their changes
+ to the broker directly.
  */
 @protocol FSQLocationSubscriber<NSObject>
 
@@ -394,6 +446,16 @@ typedef NS_OPTIONS(NSUInteger, FSQLocationSubscriberOptions) {
 
 #pragma mark - FSQVisitMonitoringSubscriber Protocol
 
+/**
+ The protocol for subscribing to visit monitoring events.
+ 
+ The shouldMonitorVisits property **must be** KVO compliant OR **implementors must call**
+ [[FSQLocationBroker shared] refreshVisitSubscribers] after changing its return value
+ in order for changes to take place.
+ 
+ Subscribers conforming to FSQSubscriberChangeNotifying are not observed and must instead report their changes
+ to the broker directly.
+ */
 @protocol FSQVisitMonitoringSubscriber <NSObject>
 
 @property (nonatomic, readonly) BOOL shouldMonitorVisits;
@@ -425,6 +487,9 @@ typedef NS_OPTIONS(NSUInteger, FSQLocationSubscriberOptions) {
  There is no guarantee changing the return values will affect _FSQLocationBroker_ behavior if
  you do not refresh the subscribers list. The broker will automatically try to observe and refresh after
  values change for KVO compliant properties.
+ 
+ Subscribers conforming to FSQSubscriberChangeNotifying are not observed and must instead report their changes
+ to the broker directly.
  */
 @protocol FSQRegionMonitoringSubscriber<NSObject>
 
@@ -519,4 +584,22 @@ typedef NS_OPTIONS(NSUInteger, FSQLocationSubscriberOptions) {
 
 @end
 
+#pragma mark - FSQSubscriberChangeNotifying Protocol
+
+/**
+ Opt-in protocol for subscribers that tell the broker about their own changes instead of relying on KVO.
+ 
+ When a subscriber conforming to this protocol is added, the broker does not register itself as a key-value observer
+ of the subscriber. Instead the subscriber **must call** the matching broker method after changing any of the
+ properties the broker would otherwise observe:
+ 
+ * FSQLocationSubscriber: `locationSubscriberDidChange:` (desiredAccuracy, locationSubscriberOptions)
+ * FSQRegionMonitoringSubscriber: `regionMonitoringSubscriberDidChange:` (monitoredRegions)
+ * FSQVisitMonitoringSubscriber: `visitSubscriberDidChange:` (shouldMonitorVisits)
+ 
+ This avoids the cost of KVO registration and removal for subscribers that are added and removed frequently.
+ */
+@protocol FSQSubscriberChangeNotifying<NSObject>
+@end
+
 NS_ASSUME_NONNULL_END
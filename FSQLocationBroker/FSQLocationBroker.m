@@ -21,6 +21,108 @@ BOOL subscriberShouldReceiveErrors(NSObject<FSQLocationSubscriber> *locationSubs
 BOOL subscriberWantsContinuousLocation(NSObject<FSQLocationSubscriber> *locationSubscriber);
 BOOL subscriberWantsSLCMonitoring(NSObject<FSQLocationSubscriber> *locationSubscriber);
 BOOL subscriberWantsVisitMonitoring(NSObject<FSQVisitMonitoringSubscriber> *locationSubscriber);
+BOOL subscriberNotifiesChanges(NSObject *subscriber);
+
+#pragma mark - FSQSubscriberGenerations
+
+/**
+ Change generation bookkeeping for one subscriber type of the broker.
+ 
+ Each FSQSubscriberChangeNotifying subscriber has a generation that is bumped every time it reports a change. A single
+ pending flag coalesces the refreshes those changes require.
+ 
+ All methods are thread safe.
+ */
+@interface FSQSubscriberGenerations : NSObject
+
+- (void)trackSubscriber:(NSObject *)subscriber;
+- (void)untrackSubscriber:(NSObject *)subscriber;
+- (void)untrackAllSubscribers;
+
+/**
+ Bumps the subscriber's generation.
+ 
+ @return YES if the caller should schedule a refresh, NO if the subscriber is not tracked or a refresh is
+ already pending.
+ */
+- (BOOL)noteChangeForSubscriber:(NSObject *)subscriber;
+
+/**
+ Clears the pending flag. Call this right before running the refresh scheduled by `noteChangeForSubscriber:`.
+ */
+- (void)clearPendingRefresh;
+
+- (NSUInteger)generationForSubscriber:(NSObject *)subscriber;
+
+@end
+
+@interface FSQSubscriberGenerations ()
+
+@property (nonatomic) NSMapTable *generations;
+@property (nonatomic) BOOL isRefreshPending;
+
+@end
+
+@implementation FSQSubscriberGenerations
+
+- (instancetype)init {
+    if ((self = [super init])) {
+        self.generations = [NSMapTable strongToStrongObjectsMapTable];
+        self.isRefreshPending = NO;
+    }
+    return self;
+}
+
+- (void)trackSubscriber:(NSObject *)subscriber {
+    @synchronized(self) {
+        [self.generations setObject:@0 forKey:subscriber];
+    }
+}
+
+- (void)untrackSubscriber:(NSObject *)subscriber {
+    @synchronized(self) {
+        [self.generations removeObjectForKey:subscriber];
+    }
+}
+
+- (void)untrackAllSubscribers {
+    @synchronized(self) {
+        [self.generations removeAllObjects];
+    }
+}
+
+- (BOOL)noteChangeForSubscriber:(NSObject *)subscriber {
+    @synchronized(self) {
+        NSNumber *generation = [self.generations objectForKey:subscriber];
+        if (!generation) {
+            return NO;
+        }
+        
+        [self.generations setObject:@([generation unsignedIntegerValue] + 1) forKey:subscriber];
+        
+        if (self.isRefreshPending) {
+            return NO;
+        }
+        self.isRefreshPending = YES;
+        return YES;
+    }
+}
+
+- (void)clearPendingRefresh {
+    @synchronized(self) {
+        self.isRefreshPending = NO;
+    }
+}
+
+- (NSUInteger)generationForSubscriber:(NSObject *)subscriber {
+    @synchronized(self) {
+        return [[self.generations objectForKey:subscriber] unsignedIntegerValue];
+    }
+}
+
+@end
+
+#pragma mark - FSQLocationBroker
 
 @interface FSQLocationBroker ()
 
@@ -34,6 +136,7 @@ BOOL subscriberWantsVisitMonitoring(NSObject<FSQVisitMonitoringSubscriber> *loca
 @property (nonatomic) CLLocationManager *locationManager;
 @property (nonatomic) BOOL isMonitoringSignificantLocation, isUpdatingLocation, isMonitoringVisits;
 @property (nonatomic) dispatch_queue_t serialQueue;
+@property (nonatomic) FSQSubscriberGenerations *locationSubscriberGenerations, *regionSubscriberGenerations, *visitSubscriberGenerations;
 
 @end
 
@@ -90,6 +193,10 @@ static Class sharedInstanceClass = nil;
         
         self.serialQueue = dispatch_queue_create("LocationBrokerSubscriberMutations", DISPATCH_QUEUE_SERIAL);
         
+        self.locationSubscriberGenerations = [FSQSubscriberGenerations new];
+        self.regionSubscriberGenerations = [FSQSubscriberGenerations new];
+        self.visitSubscriberGenerations = [FSQSubscriberGenerations new];
+        
         [[NSNotificationCenter defaultCenter] addObserver:self
                                                  selector:@selector(applicationDidEnterBackground:)
                                                      name:UIApplicationDidEnterBackgroundNotification
@@ -106,6 +213,9 @@ static Class sharedInstanceClass = nil;
 - (void)removeAllSubscribers {
     dispatch_async(self.serialQueue, ^{
         for (NSObject<FSQLocationSubscriber> *locationSubscriber in self.locationSubscribers) {
+            if (subscriberNotifiesChanges(locationSubscriber)) {
+                continue;
+            }
             @try {
                 [locationSubscriber removeObserver:self forKeyPath:NSStringFromSelector(@selector(desiredAccuracy))];
             } @catch (NSException * __unused exception) {}
@@ -115,6 +225,9 @@ static Class sharedInstanceClass = nil;
         }
         
         for (NSObject<FSQRegionMonitoringSubscriber> *regionSubscriber in self.regionSubscribers) {
+            if (subscriberNotifiesChanges(regionSubscriber)) {
+                continue;
+            }
             @try {
                 [regionSubscriber removeObserver:self forKeyPath:NSStringFromSelector(@selector(monitoredRegions))];
             } @catch (NSException * __unused exception) {}
@@ -124,6 +237,10 @@ static Class sharedInstanceClass = nil;
         self.regionSubscribers = [NSSet new];
         self.visitSubscribers = [NSSet new];
         
+        [self.locationSubscriberGenerations untrackAllSubscribers];
+        [self.regionSubscriberGenerations untrackAllSubscribers];
+        [self.visitSubscriberGenerations untrackAllSubscribers];
+        
         [self.locationManager stopMonitoringSignificantLocationChanges];
         [self.locationManager stopUpdatingLocation];
         
@@ -149,14 +266,19 @@ static Class sharedInstanceClass = nil;
     dispatch_async(self.serialQueue, ^{
         if (![self.locationSubscribers containsObject:locationSubscriber]) {
             self.locationSubscribers = [self.locationSubscribers setByAddingObject:locationSubscriber];
-            [locationSubscriber addObserver:self
-                                 forKeyPath:NSStringFromSelector(@selector(desiredAccuracy))
-                                    options:0
-                                    context:kLocationBrokerLocationSubscriberKVOContext];
-            [locationSubscriber addObserver:self
-                                 forKeyPath:NSStringFromSelector(@selector(locationSubscriberOptions))
-                                    options:0
-                                    context:kLocationBrokerLocationSubscriberKVOContext];
+            if (subscriberNotifiesChanges(locationSubscriber)) {
+                [self.locationSubscriberGenerations trackSubscriber:locationSubscriber];
+            }
+            else {
+                [locationSubscriber addObserver:self
+                                     forKeyPath:NSStringFromSelector(@selector(desiredAccuracy))
+                                        options:0
+                                        context:kLocationBrokerLocationSubscriberKVOContext];
+                [locationSubscriber addObserver:self
+                                     forKeyPath:NSStringFromSelector(@selector(locationSubscriberOptions))
+                                        options:0
+                                        context:kLocationBrokerLocationSubscriberKVOContext];
+            }
             
             [self refreshLocationSubscribers];
         }
@@ -166,12 +288,17 @@ static Class sharedInstanceClass = nil;
 - (void)removeLocationSubscriber:(NSObject<FSQLocationSubscriber> *)locationSubscriber {
     dispatch_async(self.serialQueue, ^{
         if ([self.locationSubscribers containsObject:locationSubscriber]) {
-            @try {
-                [locationSubscriber removeObserver:self forKeyPath:NSStringFromSelector(@selector(desiredAccuracy))];
-            } @catch (NSException * __unused exception) {}
-            @try {
-                [locationSubscriber removeObserver:self forKeyPath:NSStringFromSelector(@selector(locationSubscriberOptions))];
-            } @catch (NSException * __unused exception) {}
+            if (subscriberNotifiesChanges(locationSubscriber)) {
+                [self.locationSubscriberGenerations untrackSubscriber:locationSubscriber];
+            }
+            else {
+                @try {
+                    [locationSubscriber removeObserver:self forKeyPath:NSStringFromSelector(@selector(desiredAccuracy))];
+                } @catch (NSException * __unused exception) {}
+                @try {
+                    [locationSubscriber removeObserver:self forKeyPath:NSStringFromSelector(@selector(locationSubscriberOptions))];
+                } @catch (NSException * __unused exception) {}
+            }
             
             NSMutableSet *mutableLocationSubscribers = [self.locationSubscribers mutableCopy];
             [mutableLocationSubscribers removeObject:locationSubscriber];
@@ -182,6 +309,15 @@ static Class sharedInstanceClass = nil;
     });
 }
 
+- (void)locationSubscriberDidChange:(NSObject<FSQLocationSubscriber> *)locationSubscriber {
+    if ([self.locationSubscriberGenerations noteChangeForSubscriber:locationSubscriber]) {
+        dispatch_async(dispatch_get_main_queue(), ^() {
+            [self.locationSubscriberGenerations clearPendingRefresh];
+            [self refreshLocationSubscribers];
+        });
+    }
+}
+
 - (BOOL)shouldMonitorSignificantLocationChanges {
     
     BOOL isBackgrounded = applicationIsBackgrounded();
@@ -325,10 +461,15 @@ static Class sharedInstanceClass = nil;
             }
 
             self.regionSubscribers = [self.regionSubscribers setByAddingObject:regionSubscriber];
-            [regionSubscriber addObserver:self
-                               forKeyPath:NSStringFromSelector(@selector(monitoredRegions))
-                                  options:0
-                                  context:kLocationBrokerRegionMonitoringSubscriberKVOContext];
+            if (subscriberNotifiesChanges(regionSubscriber)) {
+                [self.regionSubscriberGenerations trackSubscriber:regionSubscriber];
+            }
+            else {
+                [regionSubscriber addObserver:self
+                                   forKeyPath:NSStringFromSelector(@selector(monitoredRegions))
+                                      options:0
+                                      context:kLocationBrokerRegionMonitoringSubscriberKVOContext];
+            }
             [self refreshRegionMonitoringSubscribers];
         }
     });
@@ -337,9 +478,14 @@ static Class sharedInstanceClass = nil;
 - (void)removeRegionMonitoringSubscriber:(NSObject<FSQRegionMonitoringSubscriber> *)regionSubscriber {
     dispatch_async(self.serialQueue, ^{
         if ([self.regionSubscribers containsObject:regionSubscriber]) {
-            @try {
-                [regionSubscriber removeObserver:self forKeyPath:NSStringFromSelector(@selector(monitoredRegions))];
-            } @catch (NSException * __unused exception) {}
+            if (subscriberNotifiesChanges(regionSubscriber)) {
+                [self.regionSubscriberGenerations untrackSubscriber:regionSubscriber];
+            }
+            else {
+                @try {
+                    [regionSubscriber removeObserver:self forKeyPath:NSStringFromSelector(@selector(monitoredRegions))];
+                } @catch (NSException * __unused exception) {}
+            }
             
             NSMutableSet *mutableRegionSubscribers = [self.regionSubscribers mutableCopy];
             [mutableRegionSubscribers removeObject:regionSubscriber];
@@ -351,6 +497,14 @@ static Class sharedInstanceClass = nil;
     });
 }
 
+- (void)regionMonitoringSubscriberDidChange:(NSObject<FSQRegionMonitoringSubscriber> *)regionSubscriber {
+    if ([self.regionSubscriberGenerations noteChangeForSubscriber:regionSubscriber]) {
+        dispatch_async(dispatch_get_main_queue(), ^() {
+            [self.regionSubscriberGenerations clearPendingRefresh];
+            [self refreshRegionMonitoringSubscribers];
+        });
+    }
+}
 
 - (void)refreshRegionMonitoringSubscribers {
     [self refreshRegionMonitoringSubscribersRemovingSubscriberWithIdentifer:nil
@@ -471,10 +625,15 @@ static Class sharedInstanceClass = nil;
         if (![self.visitSubscribers containsObject:visitSubscriber]) {
             self.visitSubscribers = [self.visitSubscribers setByAddingObject:visitSubscriber];
             
-            [visitSubscriber addObserver:self
-                                 forKeyPath:NSStringFromSelector(@selector(shouldMonitorVisits))
-                                    options:0
-                                    context:kLocationBrokerVisitSubscriberKVOContext];
+            if (subscriberNotifiesChanges(visitSubscriber)) {
+                [self.visitSubscriberGenerations trackSubscriber:visitSubscriber];
+            }
+            else {
+                [visitSubscriber addObserver:self
+                                  forKeyPath:NSStringFromSelector(@selector(shouldMonitorVisits))
+                                     options:0
+                                     context:kLocationBrokerVisitSubscriberKVOContext];
+            }
             
             [self refreshVisitSubscribers];
         }
@@ -484,9 +643,14 @@ static Class sharedInstanceClass = nil;
 - (void)removeVisitSubscriber:(NSObject<FSQVisitMonitoringSubscriber> *)visitSubscriber {
     dispatch_async(self.serialQueue, ^{
         if ([self.visitSubscribers containsObject:visitSubscriber]) {
-            @try {
-                [visitSubscriber removeObserver:self forKeyPath:NSStringFromSelector(@selector(shouldMonitorVisits))];
-            } @catch (NSException * __unused exception) {}
+            if (subscriberNotifiesChanges(visitSubscriber)) {
+                [self.visitSubscriberGenerations untrackSubscriber:visitSubscriber];
+            }
+            else {
+                @try {
+                    [visitSubscriber removeObserver:self forKeyPath:NSStringFromSelector(@selector(shouldMonitorVisits))];
+                } @catch (NSException * __unused exception) {}
+            }
             
             NSMutableSet *mutableVisitSubscribers = [self.visitSubscribers mutableCopy];
             [mutableVisitSubscribers removeObject:visitSubscriber];
@@ -497,6 +661,15 @@ static Class sharedInstanceClass = nil;
     });
 }
 
+- (void)visitSubscriberDidChange:(NSObject<FSQVisitMonitoringSubscriber> *)visitSubscriber {
+    if ([self.visitSubscriberGenerations noteChangeForSubscriber:visitSubscriber]) {
+        dispatch_async(dispatch_get_main_queue(), ^() {
+            [self.visitSubscriberGenerations clearPendingRefresh];
+            [self refreshVisitSubscribers];
+        });
+    }
+}
+
 - (void)refreshVisitSubscribers {
     if (![NSThread isMainThread]) {
         dispatch_async(dispatch_get_main_queue(), ^() {
@@ -515,6 +688,14 @@ static Class sharedInstanceClass = nil;
     }
 }
 
+#pragma mark Change Generations
+
+- (NSUInteger)changeGenerationForSubscriber:(NSObject<FSQSubscriberChangeNotifying> *)subscriber {
+    return ([self.locationSubscriberGenerations generationForSubscriber:subscriber]
+            + [self.regionSubscriberGenerations generationForSubscriber:subscriber]
+            + [self.visitSubscriberGenerations generationForSubscriber:subscriber]);
+}
+
 #pragma mark CLLocationManagerDelegate
 
 - (void)locationManager:(CLLocationManager *)manager didUpdateLocations:(NSArray *)locations {
@@ -712,4 +893,8 @@ BOOL subscriberWantsVisitMonitoring(NSObject<FSQVisitMonitoringSubscriber> *loca
     return locationSubscriber.shouldMonitorVisits;
 }
 
+BOOL subscriberNotifiesChanges(NSObject *subscriber) {
+    return [subscriber conformsToProtocol:@protocol(FSQSubscriberChangeNotifying)];
+}
+
 NS_ASSUME_NONNULL_END